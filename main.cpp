@@ -2,6 +2,10 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <array>
+#include <mutex>
+#include <stdexcept>
+#include <cstdlib>
 #include <curl/curl.h>
 #include <nlohmann/json.hpp>
 
@@ -82,12 +86,152 @@ const std::string ColorUtils::BG_RED = "\033[41m";
 const std::string ColorUtils::BG_GREEN = "\033[42m";
 const std::string ColorUtils::BG_BLUE = "\033[44m";
 
+// Pooled keep-alive curl handles shared across all API calls.
+// Idle easy handles are reused so requests ride on their own already-open
+// connections, and a curl_share object caches DNS and TLS sessions between them.
+// The connection cache is deliberately not shared: libcurl does not support
+// sharing it across concurrently running handles.
+class CurlConnectionPool {
+private:
+    CURLSH* share;
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> share_locks;
+    std::mutex pool_mutex;
+    std::vector<CURL*> idle_handles;
+    size_t max_idle;
+    std::string unix_socket_path;
+    struct curl_slist* json_headers;
+    
+    static void lockShare(CURL*, curl_lock_data data, curl_lock_access, void* userp) {
+        static_cast<CurlConnectionPool*>(userp)->share_locks[data].lock();
+    }
+    
+    static void unlockShare(CURL*, curl_lock_data data, void* userp) {
+        static_cast<CurlConnectionPool*>(userp)->share_locks[data].unlock();
+    }
+    
+    // Options every request gets; re-applied after curl_easy_reset on return
+    void applyDefaults(CURL* handle) {
+        curl_easy_setopt(handle, CURLOPT_SHARE, share);
+        curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);  // Required for multi-threaded use
+        curl_easy_setopt(handle, CURLOPT_TCP_NODELAY, 1L);
+        curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+        curl_easy_setopt(handle, CURLOPT_TCP_KEEPIDLE, 60L);
+        curl_easy_setopt(handle, CURLOPT_TCP_KEEPINTVL, 30L);
+        curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT, 5L);
+        if (!unix_socket_path.empty()) {
+            curl_easy_setopt(handle, CURLOPT_UNIX_SOCKET_PATH, unix_socket_path.c_str());
+        }
+    }
+    
+public:
+    // RAII checkout of a pooled handle; returns it to the pool when destroyed
+    class Handle {
+    private:
+        CurlConnectionPool* pool;
+        CURL* handle;
+        
+    public:
+        Handle(CurlConnectionPool* owner, CURL* h) : pool(owner), handle(h) {}
+        Handle(Handle&& other) noexcept : pool(other.pool), handle(other.handle) {
+            other.handle = nullptr;
+        }
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+        Handle& operator=(Handle&&) = delete;
+        
+        ~Handle() {
+            if (handle) {
+                pool->release(handle);
+            }
+        }
+        
+        CURL* get() const {
+            return handle;
+        }
+    };
+    
+    CurlConnectionPool(const std::string& socket_path = "", size_t max_idle_handles = 4)
+        : share(nullptr), max_idle(max_idle_handles), unix_socket_path(socket_path), json_headers(nullptr) {
+        share = curl_share_init();
+        if (!share) {
+            throw std::runtime_error("Failed to initialize libcurl share handle");
+        }
+        curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lockShare);
+        curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlockShare);
+        curl_share_setopt(share, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        
+        // Built once and shared read-only by every POST request
+        json_headers = curl_slist_append(json_headers, "Content-Type: application/json");
+        if (!json_headers) {
+            curl_share_cleanup(share);
+            throw std::runtime_error("Failed to allocate HTTP headers");
+        }
+    }
+    
+    ~CurlConnectionPool() {
+        // Easy handles must be gone before the share they reference
+        for (CURL* handle : idle_handles) {
+            curl_easy_cleanup(handle);
+        }
+        curl_share_cleanup(share);
+        curl_slist_free_all(json_headers);
+    }
+    
+    CurlConnectionPool(const CurlConnectionPool&) = delete;
+    CurlConnectionPool& operator=(const CurlConnectionPool&) = delete;
+    
+    Handle acquire() {
+        {
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            if (!idle_handles.empty()) {
+                CURL* handle = idle_handles.back();
+                idle_handles.pop_back();
+                return Handle(this, handle);
+            }
+        }
+        
+        CURL* handle = curl_easy_init();
+        if (!handle) {
+            throw std::runtime_error("Failed to initialize libcurl");
+        }
+        applyDefaults(handle);
+        return Handle(this, handle);
+    }
+    
+    void release(CURL* handle) {
+        // Reset drops per-request options but keeps the live connection
+        curl_easy_reset(handle);
+        applyDefaults(handle);
+        
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        if (idle_handles.size() < max_idle) {
+            idle_handles.push_back(handle);
+            return;
+        }
+        curl_easy_cleanup(handle);
+    }
+    
+    struct curl_slist* jsonHeaders() const {
+        return json_headers;
+    }
+    
+    bool usesUnixSocket() const {
+        return !unix_socket_path.empty();
+    }
+    
+    std::string getUnixSocketPath() const {
+        return unix_socket_path;
+    }
+};
+
 class OllamaAssistant {
 private:
-    std::string api_url;
+    std::string base_url;
     std::string model_name;
     std::vector<json> conversation_history;
-    CURL* curl;
+    CurlConnectionPool pool;
     
     struct WriteCallback {
         std::string data;
@@ -100,13 +244,8 @@ private:
     }
     
 public:
-    OllamaAssistant(const std::string& model = "llama3.2") 
-        : api_url("http://localhost:11434/api/chat"), model_name(model) {
-        curl = curl_easy_init();
-        if (!curl) {
-            throw std::runtime_error("Failed to initialize libcurl");
-        }
-        
+    OllamaAssistant(const std::string& model = "llama3.2", const std::string& unix_socket = "") 
+        : base_url("http://localhost:11434"), model_name(model), pool(unix_socket) {
         // Initialize conversation with system message
         conversation_history.push_back({
             {"role", "system"},
@@ -114,33 +253,36 @@ public:
         });
     }
     
-    ~OllamaAssistant() {
-        if (curl) {
-            curl_easy_cleanup(curl);
-        }
-    }
-    
     bool checkOllamaConnection() {
-        CURL* test_curl = curl_easy_init();
-        if (!test_curl) return false;
-        
-        WriteCallback response;
-        curl_easy_setopt(test_curl, CURLOPT_URL, "http://localhost:11434/api/tags");
-        curl_easy_setopt(test_curl, CURLOPT_WRITEFUNCTION, WriteCallbackFunc);
-        curl_easy_setopt(test_curl, CURLOPT_WRITEDATA, &response);
-        curl_easy_setopt(test_curl, CURLOPT_TIMEOUT, 5L);
-        
-        CURLcode res = curl_easy_perform(test_curl);
-        curl_easy_cleanup(test_curl);
-        
-        return res == CURLE_OK;
+        try {
+            CurlConnectionPool::Handle handle = pool.acquire();
+            CURL* curl = handle.get();
+            
+            WriteCallback response;
+            std::string url = base_url + "/api/tags";
+            curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+            curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallbackFunc);
+            curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+            curl_easy_setopt(curl, CURLOPT_TIMEOUT, 5L);
+            curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+            
+            CURLcode res = curl_easy_perform(curl);
+            
+            return res == CURLE_OK;
+        } catch (const std::exception&) {
+            return false;
+        }
     }
     
     std::vector<std::string> getAvailableModels() {
         std::vector<std::string> models;
         
+        CurlConnectionPool::Handle handle = pool.acquire();
+        CURL* curl = handle.get();
+        
         WriteCallback response;
-        curl_easy_setopt(curl, CURLOPT_URL, "http://localhost:11434/api/tags");
+        std::string url = base_url + "/api/tags";
+        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
         curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallbackFunc);
         curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
         curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
@@ -191,17 +333,18 @@ public:
         
         std::string json_string = payload.dump();
         
-        // Set up HTTP headers
-        struct curl_slist* headers = nullptr;
-        headers = curl_slist_append(headers, "Content-Type: application/json");
+        CurlConnectionPool::Handle handle = pool.acquire();
+        CURL* curl = handle.get();
         
         // Set up response callback
         WriteCallback response;
         
         // Configure curl options
-        curl_easy_setopt(curl, CURLOPT_URL, api_url.c_str());
+        std::string url = base_url + "/api/chat";
+        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
         curl_easy_setopt(curl, CURLOPT_POSTFIELDS, json_string.c_str());
-        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(json_string.size()));
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, pool.jsonHeaders());
         curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallbackFunc);
         curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
         curl_easy_setopt(curl, CURLOPT_TIMEOUT, 60L);  // Longer timeout for local processing
@@ -209,7 +352,6 @@ public:
         
         // Perform the request
         CURLcode res = curl_easy_perform(curl);
-        curl_slist_free_all(headers);
         
         if (res != CURLE_OK) {
             throw std::runtime_error("HTTP request failed: " + std::string(curl_easy_strerror(res)) + 
@@ -286,6 +428,18 @@ public:
         std::cout << ColorUtils::colorize("========================", ColorUtils::CYAN) << "\n" << std::endl;
     }
     
+    std::string getBaseUrl() const {
+        return base_url;
+    }
+    
+    bool usesUnixSocket() const {
+        return pool.usesUnixSocket();
+    }
+    
+    std::string getUnixSocketPath() const {
+        return pool.getUnixSocketPath();
+    }
+    
     size_t getConversationLength() const {
         return conversation_history.size() - 1; // Exclude system message
     }
@@ -452,7 +606,10 @@ private:
         
         if (assistant->checkOllamaConnection()) {
             std::cout << ColorUtils::colorize("✅ Ollama is running and accessible!", ColorUtils::GREEN) << std::endl;
-            std::cout << ColorUtils::colorize("📡 Server: http://localhost:11434", ColorUtils::CYAN) << std::endl;
+            std::cout << ColorUtils::colorize("📡 Server: " + assistant->getBaseUrl(), ColorUtils::CYAN) << std::endl;
+            if (assistant->usesUnixSocket()) {
+                std::cout << ColorUtils::colorize("🔌 Transport: Unix socket " + assistant->getUnixSocketPath(), ColorUtils::CYAN) << std::endl;
+            }
             std::cout << ColorUtils::colorize("🤖 Current model: ", ColorUtils::CYAN) 
                      << ColorUtils::colorize(assistant->getCurrentModel(), ColorUtils::BOLD + ColorUtils::GREEN) << std::endl;
         } else {
@@ -464,9 +621,9 @@ private:
     }
     
 public:
-    TerminalInterface(const std::string& model_name = "llama3.2") {
+    TerminalInterface(const std::string& model_name = "llama3.2", const std::string& unix_socket = "") {
         try {
-            assistant = std::make_unique<OllamaAssistant>(model_name);
+            assistant = std::make_unique<OllamaAssistant>(model_name, unix_socket);
         } catch (const std::exception& e) {
             throw std::runtime_error("Failed to initialize Ollama assistant: " + std::string(e.what()));
         }
@@ -542,8 +699,14 @@ int main(int argc, char* argv[]) {
         model_name = argv[1];
     }
     
+    // Optional Unix-socket transport to a local server
+    std::string unix_socket;
+    if (const char* socket_env = std::getenv("OLLAMA_UNIX_SOCKET")) {
+        unix_socket = socket_env;
+    }
+    
     try {
-        TerminalInterface terminal(model_name);
+        TerminalInterface terminal(model_name, unix_socket);
         terminal.run();
     } catch (const std::exception& e) {
         std::cerr << ColorUtils::colorize("💥 Fatal error: ", ColorUtils::BOLD + ColorUtils::RED) 
@@ -594,6 +757,9 @@ Specific model:
 ./ollama_assistant codellama
 ./ollama_assistant phi3:mini
 
+Through a Unix socket (e.g. behind a local proxy):
+OLLAMA_UNIX_SOCKET=/run/ollama.sock ./ollama_assistant
+
 🎯 AVAILABLE COMMANDS:
 /help     - Show help and commands
 /models   - List all installed models